@@ -2,6 +2,183 @@
 
 #include "tasks.h"
 
+#include <stddef.h>
+
+// Entry in the string interning table; the text follows the header in the
+// same allocation so a string pointer can be mapped back to its entry
+typedef struct InternEntry {
+    struct InternEntry* next;
+    size_t hash;
+    size_t refCount;
+    size_t length;
+    char text[];
+} InternEntry;
+
+// Hash table of interned strings (separate chaining)
+typedef struct {
+    InternEntry** buckets;
+    size_t bucketCount;
+    size_t entryCount;
+    size_t references;
+    size_t bytes;
+} InternTable;
+
+#define INTERN_INITIAL_BUCKETS 64
+
+static InternTable internTable = { NULL, 0, 0, 0, 0 };
+
+// Function to hash a string (FNV-1a) and report its length
+static size_t hashString(const char* str, size_t* length) {
+    size_t hash = (size_t)14695981039346656037ULL;
+    const unsigned char* p = (const unsigned char*)str;
+    while (*p != '\0') {
+        hash ^= *p++;
+        hash *= (size_t)1099511628211ULL;
+    }
+    *length = (size_t)(p - (const unsigned char*)str);
+    return hash;
+}
+
+// Function to resize the interning table to the given number of buckets
+static bool resizeInternTable(size_t bucketCount) {
+    InternEntry** buckets = (InternEntry**)calloc(bucketCount, sizeof(InternEntry*));
+    if (buckets == NULL) {
+        return false;
+    }
+
+    for (size_t i = 0; i < internTable.bucketCount; i++) {
+        InternEntry* entry = internTable.buckets[i];
+        while (entry != NULL) {
+            InternEntry* next = entry->next;
+            size_t index = entry->hash & (bucketCount - 1);
+            entry->next = buckets[index];
+            buckets[index] = entry;
+            entry = next;
+        }
+    }
+
+    internTable.bytes -= internTable.bucketCount * sizeof(InternEntry*);
+    internTable.bytes += bucketCount * sizeof(InternEntry*);
+    free(internTable.buckets);
+    internTable.buckets = buckets;
+    internTable.bucketCount = bucketCount;
+    return true;
+}
+
+// Function to get a shared, reference-counted copy of a string
+static const char* internString(const char* str) {
+    size_t length;
+    size_t hash = hashString(str, &length);
+
+    if (internTable.bucketCount != 0) {
+        InternEntry* entry = internTable.buckets[hash & (internTable.bucketCount - 1)];
+        while (entry != NULL) {
+            if (entry->hash == hash && entry->length == length && memcmp(entry->text, str, length) == 0) {
+                entry->refCount++;
+                internTable.references++;
+                return entry->text;
+            }
+            entry = entry->next;
+        }
+    }
+
+    // Keep the load factor at or below 3/4 (bucket count is a power of two)
+    if (internTable.bucketCount == 0) {
+        if (!resizeInternTable(INTERN_INITIAL_BUCKETS)) {
+            return NULL;
+        }
+    } else if (internTable.entryCount + 1 > internTable.bucketCount / 4 * 3) {
+        if (!resizeInternTable(internTable.bucketCount * 2)) {
+            return NULL;
+        }
+    }
+
+    InternEntry* entry = (InternEntry*)malloc(sizeof(InternEntry) + length + 1);
+    if (entry == NULL) {
+        return NULL;
+    }
+    entry->hash = hash;
+    entry->refCount = 1;
+    entry->length = length;
+    memcpy(entry->text, str, length + 1);
+
+    size_t index = hash & (internTable.bucketCount - 1);
+    entry->next = internTable.buckets[index];
+    internTable.buckets[index] = entry;
+    internTable.entryCount++;
+    internTable.references++;
+    internTable.bytes += sizeof(InternEntry) + length + 1;
+    return entry->text;
+}
+
+// Function to drop a reference obtained from internString
+// str must be a pointer returned by internString; anything else corrupts the heap.
+static void releaseString(const char* str) {
+    InternEntry* entry = (InternEntry*)(str - offsetof(InternEntry, text));
+    internTable.references--;
+    if (--entry->refCount > 0) {
+        return;
+    }
+
+    InternEntry** link = &internTable.buckets[entry->hash & (internTable.bucketCount - 1)];
+    while (*link != entry) {
+        link = &(*link)->next;
+    }
+    *link = entry->next;
+    internTable.entryCount--;
+    internTable.bytes -= sizeof(InternEntry) + entry->length + 1;
+    free(entry);
+
+    // Release the table itself once the last string is gone
+    if (internTable.entryCount == 0) {
+        internTable.bytes -= internTable.bucketCount * sizeof(InternEntry*);
+        free(internTable.buckets);
+        internTable.buckets = NULL;
+        internTable.bucketCount = 0;
+    }
+}
+
+// Function to report the current state of the interning table
+InternStats getInternStats(void) {
+    InternStats stats;
+    stats.uniqueStrings = internTable.entryCount;
+    stats.references = internTable.references;
+    stats.bytes = internTable.bytes;
+    return stats;
+}
+
+// Function to store a string in a task field, inline when it is short enough
+static bool assignTaskString(const char** field, char* inlineBuffer, const char* value) {
+    const char* stored;
+    size_t length = strlen(value);
+
+    if (length < TASK_INLINE_STRING_SIZE) {
+        memmove(inlineBuffer, value, length + 1);
+        stored = inlineBuffer;
+    } else {
+        stored = internString(value);
+        if (stored == NULL) {
+            return false;
+        }
+    }
+
+    if (*field != NULL && *field != inlineBuffer) {
+        releaseString(*field);
+    }
+    *field = stored;
+    return true;
+}
+
+// Function to set the name of a task
+bool setTaskName(Task* task, const char* name) {
+    return assignTaskString(&task->name, task->nameInline, name);
+}
+
+// Function to set the description of a task
+bool setTaskDescription(Task* task, const char* description) {
+    return assignTaskString(&task->description, task->descriptionInline, description);
+}
+
 // Function to initialize the TaskList
 void initializeTaskList(TaskList* list) {
     list->firstTask = NULL;
@@ -18,10 +195,11 @@ Task* createTask(int id, const char* name, const char* date, const char* time, c
     }
 
     newTask->id = id;
+    newTask->name = NULL;
+    newTask->description = NULL;
 
-    // Allocate and copy the name
-    newTask->name = strdup(name);
-    if (newTask->name == NULL) {
+    // Store the name inline or as an interned string
+    if (!setTaskName(newTask, name)) {
         fprintf(stderr, "Error: Unable to allocate memory for task name.\n");
         free(newTask);
         exit(EXIT_FAILURE);
@@ -35,12 +213,10 @@ Task* createTask(int id, const char* name, const char* date, const char* time, c
     strncpy(newTask->time, time, sizeof(newTask->time) - 1);
     newTask->time[sizeof(newTask->time) - 1] = '\0';
 
-    // Allocate and copy the description
-    newTask->description = strdup(description);
-    if (newTask->description == NULL) {
+    // Store the description inline or as an interned string
+    if (!setTaskDescription(newTask, description)) {
         fprintf(stderr, "Error: Unable to allocate memory for task description.\n");
-        free(newTask->name);
-        free(newTask);
+        destroyTask(newTask);
         exit(EXIT_FAILURE);
     }
 
@@ -51,6 +227,17 @@ Task* createTask(int id, const char* name, const char* date, const char* time, c
     return newTask;
 }
 
+// Function to free a single Task and release its strings
+void destroyTask(Task* task) {
+    if (task->name != NULL && task->name != task->nameInline) {
+        releaseString(task->name);
+    }
+    if (task->description != NULL && task->description != task->descriptionInline) {
+        releaseString(task->description);
+    }
+    free(task);
+}
+
 // Function to add a Task to the TaskList (appends to the end)
 void addTask(TaskList* list, Task* newTask) {
     if (list->firstTask == NULL) {
@@ -66,6 +253,33 @@ void addTask(TaskList* list, Task* newTask) {
     list->count++;
 }
 
+// Function to print a single task
+static void printTask(int id, const char* name, const char* date, const char* time, const char* description, Priority priority) {
+    printf("Task ID: %d\n", id);
+    printf("Name: %s\n", name);
+    printf("Date: %s\n", date);
+    printf("Time: %s\n", time);
+    printf("Description: %s\n", description);
+    printf("Priority: ");
+    switch (priority) {
+        case LOW:
+            printf("Low\n");
+            break;
+        case MEDIUM:
+            printf("Medium\n");
+            break;
+        case HIGH:
+            printf("High\n");
+            break;
+        case CRITICAL:
+            printf("Critical\n");
+            break;
+        default:
+            printf("Unknown\n");
+    }
+    printf("-------------------------\n");
+}
+
 // Function to list all tasks
 void listTasks(const TaskList* list) {
     if (list->firstTask == NULL) {
@@ -75,29 +289,7 @@ void listTasks(const TaskList* list) {
 
     Task* current = list->firstTask;
     while (current != NULL) {
-        printf("Task ID: %d\n", current->id);
-        printf("Name: %s\n", current->name);
-        printf("Date: %s\n", current->date);
-        printf("Time: %s\n", current->time);
-        printf("Description: %s\n", current->description);
-        printf("Priority: ");
-        switch (current->priority) {
-            case LOW:
-                printf("Low\n");
-                break;
-            case MEDIUM:
-                printf("Medium\n");
-                break;
-            case HIGH:
-                printf("High\n");
-                break;
-            case CRITICAL:
-                printf("Critical\n");
-                break;
-            default:
-                printf("Unknown\n");
-        }
-        printf("-------------------------\n");
+        printTask(current->id, current->name, current->date, current->time, current->description, current->priority);
         current = current->nextTask;
     }
 }
@@ -121,9 +313,7 @@ bool deleteTask(TaskList* list, int id) {
                 list->lastTask = current->previousTask;
             }
 
-            free(current->name);
-            free(current->description);
-            free(current);
+            destroyTask(current);
             list->count--;
             return true;
         }
@@ -132,6 +322,56 @@ bool deleteTask(TaskList* list, int id) {
     return false; // Task not found
 }
 
+// New values entered by the user when updating a task
+// Fields left blank are flagged as unchanged.
+typedef struct {
+    char name[100];
+    char date[50];
+    char time[15];
+    char description[256];
+    Priority priority;
+    bool hasName;
+    bool hasDate;
+    bool hasTime;
+    bool hasDescription;
+    bool hasPriority;
+} TaskUpdate;
+
+// Function to read one field of a task update; returns false if left blank
+static bool promptTaskField(const char* prompt, char* buffer, size_t size) {
+    printf("%s", prompt);
+    if (fgets(buffer, (int)size, stdin) == NULL || buffer[0] == '\n') {
+        return false;
+    }
+    buffer[strcspn(buffer, "\n")] = '\0'; // Remove newline
+    return true;
+}
+
+// Function to ask the user for the new values of a task
+static void promptTaskUpdate(TaskUpdate* update) {
+    update->hasName = promptTaskField("Enter new name (leave blank to keep unchanged): ",
+                                      update->name, sizeof(update->name));
+    update->hasDate = promptTaskField("Enter new date (YYYY-MM-DD) (leave blank to keep unchanged): ",
+                                      update->date, sizeof(update->date));
+    update->hasTime = promptTaskField("Enter new time (HH:MM AM/PM) (leave blank to keep unchanged): ",
+                                      update->time, sizeof(update->time));
+    update->hasDescription = promptTaskField("Enter new description (leave blank to keep unchanged): ",
+                                             update->description, sizeof(update->description));
+
+    char priorityInput[10];
+    update->hasPriority = false;
+    if (promptTaskField("Enter new priority (1=Low, 2=Medium, 3=High, 4=Critical) (leave blank to keep unchanged): ",
+                        priorityInput, sizeof(priorityInput))) {
+        int priorityVal = atoi(priorityInput);
+        if (priorityVal >= LOW && priorityVal <= CRITICAL) {
+            update->priority = (Priority)priorityVal;
+            update->hasPriority = true;
+        } else {
+            printf("Invalid priority value. Keeping previous priority.\n");
+        }
+    }
+}
+
 // Function to update a task by ID
 bool updateTask(TaskList* list, int id) {
     Task* current = list->firstTask;
@@ -139,65 +379,27 @@ bool updateTask(TaskList* list, int id) {
         if (current->id == id) {
             printf("Updating Task ID: %d\n", id);
 
-            // Update Name
-            char name[100];
-            printf("Enter new name (leave blank to keep unchanged): ");
-            fgets(name, sizeof(name), stdin);
-            if (name[0] != '\n') {
-                name[strcspn(name, "\n")] = '\0'; // Remove newline
-                free(current->name);
-                current->name = strdup(name);
-                if (current->name == NULL) {
-                    fprintf(stderr, "Error: Unable to allocate memory for task name.\n");
-                    return false;
-                }
-            }
+            TaskUpdate update;
+            promptTaskUpdate(&update);
 
-            // Update Date
-            char date[50];
-            printf("Enter new date (YYYY-MM-DD) (leave blank to keep unchanged): ");
-            fgets(date, sizeof(date), stdin);
-            if (date[0] != '\n') {
-                date[strcspn(date, "\n")] = '\0'; // Remove newline
-                strncpy(current->date, date, sizeof(current->date) - 1);
+            if (update.hasName && !setTaskName(current, update.name)) {
+                fprintf(stderr, "Error: Unable to allocate memory for task name.\n");
+                return false;
+            }
+            if (update.hasDate) {
+                strncpy(current->date, update.date, sizeof(current->date) - 1);
                 current->date[sizeof(current->date) - 1] = '\0';
             }
-
-            // Update Time
-            char time[15];
-            printf("Enter new time (HH:MM AM/PM) (leave blank to keep unchanged): ");
-            fgets(time, sizeof(time), stdin);
-            if (time[0] != '\n') {
-                time[strcspn(time, "\n")] = '\0'; // Remove newline
-                strncpy(current->time, time, sizeof(current->time) - 1);
+            if (update.hasTime) {
+                strncpy(current->time, update.time, sizeof(current->time) - 1);
                 current->time[sizeof(current->time) - 1] = '\0';
             }
-
-            // Update Description
-            char description[256];
-            printf("Enter new description (leave blank to keep unchanged): ");
-            fgets(description, sizeof(description), stdin);
-            if (description[0] != '\n') {
-                description[strcspn(description, "\n")] = '\0'; // Remove newline
-                free(current->description);
-                current->description = strdup(description);
-                if (current->description == NULL) {
-                    fprintf(stderr, "Error: Unable to allocate memory for task description.\n");
-                    return false;
-                }
+            if (update.hasDescription && !setTaskDescription(current, update.description)) {
+                fprintf(stderr, "Error: Unable to allocate memory for task description.\n");
+                return false;
             }
-
-            // Update Priority
-            char priorityInput[10];
-            printf("Enter new priority (1=Low, 2=Medium, 3=High, 4=Critical) (leave blank to keep unchanged): ");
-            fgets(priorityInput, sizeof(priorityInput), stdin);
-            if (priorityInput[0] != '\n') {
-                int priorityVal = atoi(priorityInput);
-                if (priorityVal >= LOW && priorityVal <= CRITICAL) {
-                    current->priority = (Priority)priorityVal;
-                } else {
-                    printf("Invalid priority value. Keeping previous priority.\n");
-                }
+            if (update.hasPriority) {
+                current->priority = update.priority;
             }
 
             printf("Task updated successfully.\n");
@@ -214,15 +416,20 @@ void freeTaskList(TaskList* list) {
     while (current != NULL) {
         Task* temp = current;
         current = current->nextTask;
-        free(temp->name);
-        free(temp->description);
-        free(temp);
+        destroyTask(temp);
     }
     list->firstTask = NULL;
     list->lastTask = NULL;
     list->count = 0;
 }
 
+// Function to write a single task as a CSV line
+// Format: id,"name","date","time","description",priority
+static void writeTaskLine(FILE* file, int id, const char* name, const char* date, const char* time, const char* description, Priority priority) {
+    fprintf(file, "%d,\"%s\",\"%s\",\"%s\",\"%s\",%d\n",
+            id, name, date, time, description, priority);
+}
+
 // Function to save tasks to a CSV file
 bool saveTasksToFile(const TaskList* list, const char* filename) {
     FILE* file = fopen(filename, "w");
@@ -233,13 +440,7 @@ bool saveTasksToFile(const TaskList* list, const char* filename) {
 
     Task* current = list->firstTask;
     while (current != NULL) {
-        fprintf(file, "%d,\"%s\",\"%s\",\"%s\",\"%s\",%d\n",
-                current->id,
-                current->name,
-                current->date,
-                current->time,
-                current->description,
-                current->priority);
+        writeTaskLine(file, current->id, current->name, current->date, current->time, current->description, current->priority);
         current = current->nextTask;
     }
 
@@ -247,6 +448,31 @@ bool saveTasksToFile(const TaskList* list, const char* filename) {
     return true;
 }
 
+// Fields of a task as read from a CSV line
+typedef struct {
+    int id;
+    char name[100];
+    char date[50];
+    char time[15];
+    char description[256];
+    Priority priority;
+} TaskRecord;
+
+// Function to parse a single CSV line; returns false if it is malformed
+static bool parseTaskLine(const char* line, TaskRecord* record) {
+    int priorityVal;
+
+    // Format: id,"name","date","time","description",priority
+    int numFields = sscanf(line, "%d,\"%[^\"]\",\"%[^\"]\",\"%[^\"]\",\"%[^\"]\",%d",
+                           &record->id, record->name, record->date, record->time, record->description, &priorityVal);
+    if (numFields != 6) {
+        return false;
+    }
+
+    record->priority = (Priority)priorityVal;
+    return true;
+}
+
 // Function to load tasks from a CSV file
 bool loadTasksFromFile(TaskList* list, const char* filename) {
     FILE* file = fopen(filename, "r");
@@ -257,21 +483,10 @@ bool loadTasksFromFile(TaskList* list, const char* filename) {
 
     char line[512];
     while (fgets(line, sizeof(line), file)) {
-        int id;
-        char name[100];
-        char date[50];
-        char time[15];
-        char description[256];
-        int priorityVal;
-
-        // Parse the CSV line
-        // Format: id,"name","date","time","description",priority
-        int numFields = sscanf(line, "%d,\"%[^\"]\",\"%[^\"]\",\"%[^\"]\",\"%[^\"]\",%d",
-                               &id, name, date, time, description, &priorityVal);
-
-        if (numFields == 6) {
+        TaskRecord record;
+        if (parseTaskLine(line, &record)) {
             // Create and add the task
-            Task* task = createTask(id, name, date, time, description, (Priority)priorityVal);
+            Task* task = createTask(record.id, record.name, record.date, record.time, record.description, record.priority);
             addTask(list, task);
         }
     }
@@ -285,3 +500,581 @@ void clearInputBuffer(void) {
     int c;
     while ((c = getchar()) != '\n' && c != EOF);
 }
+
+// Compact task list
+
+#define COMPACT_INITIAL_CAPACITY 16
+#define STRING_HEAP_INITIAL_SIZE 256
+#define STRING_HEAP_INITIAL_SLOTS 64
+
+// Each heap string is preceded by its 32-bit reference count
+#define HEAP_STRING_HEADER ((uint32_t)sizeof(uint32_t))
+
+// Function to read the reference count of a heap string
+static uint32_t getHeapRefCount(const StringHeap* heap, uint32_t offset) {
+    uint32_t refCount;
+    memcpy(&refCount, heap->data + offset - HEAP_STRING_HEADER, sizeof(refCount));
+    return refCount;
+}
+
+// Function to write the reference count of a heap string
+static void setHeapRefCount(StringHeap* heap, uint32_t offset, uint32_t refCount) {
+    memcpy(heap->data + offset - HEAP_STRING_HEADER, &refCount, sizeof(refCount));
+}
+
+// Function to find the index slot of a string in the heap, or the empty slot
+// where it would be inserted
+static uint32_t* findHeapSlot(const StringHeap* heap, const char* str, size_t hash) {
+    uint32_t mask = heap->slotCount - 1;
+    uint32_t index = (uint32_t)hash & mask;
+    while (heap->slots[index] != 0) {
+        if (strcmp(heap->data + heap->slots[index], str) == 0) {
+            break;
+        }
+        index = (index + 1) & mask;
+    }
+    return &heap->slots[index];
+}
+
+// Function to double the index of the string heap
+static bool growHeapSlots(StringHeap* heap) {
+    uint32_t slotCount = heap->slotCount == 0 ? STRING_HEAP_INITIAL_SLOTS : heap->slotCount * 2;
+    uint32_t* slots = (uint32_t*)calloc(slotCount, sizeof(uint32_t));
+    if (slots == NULL) {
+        return false;
+    }
+
+    uint32_t* oldSlots = heap->slots;
+    uint32_t oldCount = heap->slotCount;
+    heap->slots = slots;
+    heap->slotCount = slotCount;
+
+    for (uint32_t i = 0; i < oldCount; i++) {
+        if (oldSlots[i] != 0) {
+            const char* stored = heap->data + oldSlots[i];
+            size_t length;
+            size_t hash = hashString(stored, &length);
+            *findHeapSlot(heap, stored, hash) = oldSlots[i];
+        }
+    }
+
+    free(oldSlots);
+    return true;
+}
+
+// Function to take a reference on a string in the heap and get its offset
+// Identical strings share a single copy.
+static bool storeHeapString(StringHeap* heap, const char* str, uint32_t* offset) {
+    size_t length;
+    size_t hash = hashString(str, &length);
+
+    // Keep the index load factor at or below 3/4
+    if (heap->slotCount == 0 || heap->slotsUsed + 1 > heap->slotCount / 4 * 3) {
+        if (!growHeapSlots(heap)) {
+            return false;
+        }
+    }
+
+    uint32_t* slot = findHeapSlot(heap, str, hash);
+    if (*slot != 0) {
+        uint32_t refCount = getHeapRefCount(heap, *slot);
+        if (refCount == 0) {
+            // Revive a string that was waiting for compaction
+            heap->garbage -= HEAP_STRING_HEADER + (uint32_t)length + 1;
+        }
+        setHeapRefCount(heap, *slot, refCount + 1);
+        *offset = *slot;
+        return true;
+    }
+
+    // Offsets are stored in 32 bits
+    if (HEAP_STRING_HEADER + length + 1 > (size_t)(UINT32_MAX - heap->size)) {
+        return false;
+    }
+    uint32_t needed = heap->size + HEAP_STRING_HEADER + (uint32_t)length + 1;
+    if (needed > heap->capacity) {
+        size_t capacity = heap->capacity == 0 ? STRING_HEAP_INITIAL_SIZE : (size_t)heap->capacity * 2;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        if (capacity > UINT32_MAX) {
+            capacity = UINT32_MAX;
+        }
+        char* data = (char*)realloc(heap->data, capacity);
+        if (data == NULL) {
+            return false;
+        }
+        heap->data = data;
+        heap->capacity = (uint32_t)capacity;
+    }
+
+    *offset = heap->size + HEAP_STRING_HEADER;
+    setHeapRefCount(heap, *offset, 1);
+    memcpy(heap->data + *offset, str, length + 1);
+    *slot = *offset;
+    heap->size = needed;
+    heap->slotsUsed++;
+    return true;
+}
+
+// Function to drop a reference on a heap string
+// Unreferenced strings stay in place until the heap is compacted.
+static void releaseHeapString(StringHeap* heap, uint32_t offset) {
+    uint32_t refCount = getHeapRefCount(heap, offset) - 1;
+    setHeapRefCount(heap, offset, refCount);
+    if (refCount == 0) {
+        heap->garbage += HEAP_STRING_HEADER + (uint32_t)strlen(heap->data + offset) + 1;
+    }
+}
+
+// Function to replace the heap string referenced by offset
+static bool replaceHeapString(StringHeap* heap, uint32_t* offset, const char* str) {
+    uint32_t newOffset;
+    if (!storeHeapString(heap, str, &newOffset)) {
+        return false;
+    }
+    releaseHeapString(heap, *offset);
+    *offset = newOffset;
+    return true;
+}
+
+// Function to rebuild the string heap without its unreferenced strings
+// Live strings keep their order; every task offset is remapped.
+static void compactStringHeap(CompactTaskList* list) {
+    StringHeap* heap = &list->strings;
+    uint32_t liveSize = heap->size - heap->garbage;
+    uint32_t capacity = liveSize < STRING_HEAP_INITIAL_SIZE ? STRING_HEAP_INITIAL_SIZE : liveSize;
+    char* data = (char*)malloc(capacity);
+    uint32_t* slots = (uint32_t*)calloc(heap->slotCount, sizeof(uint32_t));
+    if (data == NULL || slots == NULL) {
+        // Keep the current heap; compaction is retried on the next release
+        free(data);
+        free(slots);
+        return;
+    }
+
+    // Copy live strings, leaving each one's new offset in its old header
+    uint32_t size = 0;
+    uint32_t position = 0;
+    while (position < heap->size) {
+        uint32_t offset = position + HEAP_STRING_HEADER;
+        uint32_t entrySize = HEAP_STRING_HEADER + (uint32_t)strlen(heap->data + offset) + 1;
+        if (getHeapRefCount(heap, offset) > 0) {
+            memcpy(data + size, heap->data + position, entrySize);
+            setHeapRefCount(heap, offset, size + HEAP_STRING_HEADER);
+            size += entrySize;
+        }
+        position += entrySize;
+    }
+
+    // Point every task at the new copies
+    uint32_t current = list->firstTask;
+    while (current != COMPACT_TASK_NONE) {
+        CompactTask* task = &list->tasks[current];
+        task->nameOffset = getHeapRefCount(heap, task->nameOffset);
+        task->descriptionOffset = getHeapRefCount(heap, task->descriptionOffset);
+        if (task->flags & COMPACT_DATE_RAW) {
+            task->date = getHeapRefCount(heap, task->date);
+        }
+        if (task->flags & COMPACT_TIME_RAW) {
+            task->time = getHeapRefCount(heap, task->time);
+        }
+        current = task->nextTask;
+    }
+
+    free(heap->data);
+    free(heap->slots);
+    heap->data = data;
+    heap->size = size;
+    heap->capacity = capacity;
+    heap->garbage = 0;
+    heap->slots = slots;
+    heap->slotsUsed = 0;
+
+    // Rebuild the index over the new copies
+    position = 0;
+    while (position < heap->size) {
+        uint32_t offset = position + HEAP_STRING_HEADER;
+        size_t length;
+        size_t hash = hashString(heap->data + offset, &length);
+        *findHeapSlot(heap, heap->data + offset, hash) = offset;
+        heap->slotsUsed++;
+        position = offset + (uint32_t)length + 1;
+    }
+}
+
+// Function to compact the string heap once most of it is unreferenced
+static void trimStringHeap(CompactTaskList* list) {
+    StringHeap* heap = &list->strings;
+    if (heap->garbage >= STRING_HEAP_INITIAL_SIZE && heap->garbage > heap->size / 2) {
+        compactStringHeap(list);
+    }
+}
+
+// Function to format a packed date
+static void formatCompactDate(uint32_t packed, uint8_t flags, char* buffer, size_t size) {
+    char separator = (flags & COMPACT_DATE_SLASH) ? '/' : '-';
+    snprintf(buffer, size, "%04u%c%02u%c%02u",
+             (unsigned)(packed >> 9), separator, (unsigned)((packed >> 5) & 0xF), separator, (unsigned)(packed & 0x1F));
+}
+
+// Function to format a packed time
+static void formatCompactTime(uint32_t packed, uint8_t flags, char* buffer, size_t size) {
+    unsigned hour = packed / 60;
+    unsigned minute = packed % 60;
+    if (flags & COMPACT_TIME_12H) {
+        snprintf(buffer, size, "%02u:%02u %s", hour % 12 == 0 ? 12 : hour % 12, minute, hour < 12 ? "AM" : "PM");
+    } else {
+        snprintf(buffer, size, "%02u:%02u", hour, minute);
+    }
+}
+
+// Function to pack a date; returns false if it would not format back exactly
+static bool packCompactDate(const char* date, uint32_t* packed, uint8_t* flags) {
+    unsigned year, month, day;
+    char separator, secondSeparator;
+    if (sscanf(date, "%4u%c%2u%c%2u", &year, &separator, &month, &secondSeparator, &day) != 5 ||
+        separator != secondSeparator || (separator != '-' && separator != '/') ||
+        month < 1 || month > 12 || day < 1 || day > 31) {
+        return false;
+    }
+
+    *packed = (uint32_t)(year << 9 | month << 5 | day);
+    *flags = separator == '/' ? COMPACT_DATE_SLASH : 0;
+
+    char check[16];
+    formatCompactDate(*packed, *flags, check, sizeof(check));
+    return strcmp(check, date) == 0;
+}
+
+// Function to pack a time; returns false if it would not format back exactly
+static bool packCompactTime(const char* time, uint32_t* packed, uint8_t* flags) {
+    unsigned hour, minute;
+    char suffix[3];
+    int numFields = sscanf(time, "%2u:%2u %2s", &hour, &minute, suffix);
+
+    if (numFields == 3 && hour >= 1 && hour <= 12 && minute < 60 &&
+        (strcmp(suffix, "AM") == 0 || strcmp(suffix, "PM") == 0)) {
+        *packed = (uint32_t)(((hour % 12) + (suffix[0] == 'P' ? 12 : 0)) * 60 + minute);
+        *flags = COMPACT_TIME_12H;
+    } else if (numFields == 2 && hour < 24 && minute < 60) {
+        *packed = (uint32_t)(hour * 60 + minute);
+        *flags = 0;
+    } else {
+        return false;
+    }
+
+    char check[16];
+    formatCompactTime(*packed, *flags, check, sizeof(check));
+    return strcmp(check, time) == 0;
+}
+
+// Function to set the date of a compact task, packed when possible
+static bool setCompactDate(CompactTaskList* list, CompactTask* task, const char* date) {
+    uint32_t value;
+    uint8_t flags;
+    if (!packCompactDate(date, &value, &flags)) {
+        if (!storeHeapString(&list->strings, date, &value)) {
+            return false;
+        }
+        flags = COMPACT_DATE_RAW;
+    }
+    if (task->flags & COMPACT_DATE_RAW) {
+        releaseHeapString(&list->strings, task->date);
+    }
+    task->date = value;
+    task->flags = (uint8_t)((task->flags & ~(COMPACT_DATE_RAW | COMPACT_DATE_SLASH)) | flags);
+    return true;
+}
+
+// Function to set the time of a compact task, packed when possible
+static bool setCompactTime(CompactTaskList* list, CompactTask* task, const char* time) {
+    uint32_t value;
+    uint8_t flags;
+    if (!packCompactTime(time, &value, &flags)) {
+        if (!storeHeapString(&list->strings, time, &value)) {
+            return false;
+        }
+        flags = COMPACT_TIME_RAW;
+    }
+    if (task->flags & COMPACT_TIME_RAW) {
+        releaseHeapString(&list->strings, task->time);
+    }
+    task->time = value;
+    task->flags = (uint8_t)((task->flags & ~(COMPACT_TIME_RAW | COMPACT_TIME_12H)) | flags);
+    return true;
+}
+
+// Function to take a node for a new task, reusing deleted ones first
+static uint32_t allocateCompactTask(CompactTaskList* list) {
+    if (list->freeTask != COMPACT_TASK_NONE) {
+        uint32_t index = list->freeTask;
+        list->freeTask = list->tasks[index].nextTask;
+        return index;
+    }
+
+    if (list->used == list->capacity) {
+        // COMPACT_TASK_NONE itself can never be a valid index
+        if (list->capacity == COMPACT_TASK_NONE) {
+            return COMPACT_TASK_NONE;
+        }
+        size_t capacity = list->capacity == 0 ? COMPACT_INITIAL_CAPACITY : (size_t)list->capacity * 2;
+        if (capacity > COMPACT_TASK_NONE) {
+            capacity = COMPACT_TASK_NONE;
+        }
+        CompactTask* tasks = (CompactTask*)realloc(list->tasks, capacity * sizeof(CompactTask));
+        if (tasks == NULL) {
+            return COMPACT_TASK_NONE;
+        }
+        list->tasks = tasks;
+        list->capacity = (uint32_t)capacity;
+    }
+    return list->used++;
+}
+
+// Function to initialize the CompactTaskList
+void initializeCompactTaskList(CompactTaskList* list) {
+    list->tasks = NULL;
+    list->capacity = 0;
+    list->used = 0;
+    list->freeTask = COMPACT_TASK_NONE;
+    list->firstTask = COMPACT_TASK_NONE;
+    list->lastTask = COMPACT_TASK_NONE;
+    list->count = 0;
+    list->strings.data = NULL;
+    list->strings.size = 0;
+    list->strings.capacity = 0;
+    list->strings.slots = NULL;
+    list->strings.slotCount = 0;
+    list->strings.slotsUsed = 0;
+    list->strings.garbage = 0;
+}
+
+// Function to add a task to the CompactTaskList (appends to the end)
+// Returns the index of the new task, or COMPACT_TASK_NONE if priority is not
+// between LOW and CRITICAL (it is stored in a single byte).
+uint32_t addCompactTask(CompactTaskList* list, int id, const char* name, const char* date, const char* time, const char* description, Priority priority) {
+    if (priority < LOW || priority > CRITICAL) {
+        return COMPACT_TASK_NONE;
+    }
+
+    uint32_t index = allocateCompactTask(list);
+    if (index == COMPACT_TASK_NONE) {
+        fprintf(stderr, "Error: Unable to allocate memory for new task.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    CompactTask* task = &list->tasks[index];
+    task->id = id;
+    task->flags = 0;
+    task->priority = (uint8_t)priority;
+    if (!storeHeapString(&list->strings, name, &task->nameOffset) ||
+        !storeHeapString(&list->strings, description, &task->descriptionOffset) ||
+        !setCompactDate(list, task, date) ||
+        !setCompactTime(list, task, time)) {
+        fprintf(stderr, "Error: Unable to allocate memory for task strings.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    task->nextTask = COMPACT_TASK_NONE;
+    task->previousTask = list->lastTask;
+    if (list->lastTask == COMPACT_TASK_NONE) {
+        list->firstTask = index;
+    } else {
+        list->tasks[list->lastTask].nextTask = index;
+    }
+    list->lastTask = index;
+    list->count++;
+    return index;
+}
+
+// Function to find a task by ID; returns COMPACT_TASK_NONE if not found
+uint32_t findCompactTask(const CompactTaskList* list, int id) {
+    uint32_t current = list->firstTask;
+    while (current != COMPACT_TASK_NONE) {
+        if (list->tasks[current].id == id) {
+            return current;
+        }
+        current = list->tasks[current].nextTask;
+    }
+    return COMPACT_TASK_NONE;
+}
+
+// Function to get the name of a compact task
+const char* compactTaskName(const CompactTaskList* list, const CompactTask* task) {
+    return list->strings.data + task->nameOffset;
+}
+
+// Function to get the description of a compact task
+const char* compactTaskDescription(const CompactTaskList* list, const CompactTask* task) {
+    return list->strings.data + task->descriptionOffset;
+}
+
+// Function to get the date of a compact task
+// Packed dates are formatted into buffer; raw ones point into the string heap.
+const char* compactTaskDate(const CompactTaskList* list, const CompactTask* task, char* buffer, size_t size) {
+    if (task->flags & COMPACT_DATE_RAW) {
+        return list->strings.data + task->date;
+    }
+    formatCompactDate(task->date, task->flags, buffer, size);
+    return buffer;
+}
+
+// Function to get the time of a compact task
+// Packed times are formatted into buffer; raw ones point into the string heap.
+const char* compactTaskTime(const CompactTaskList* list, const CompactTask* task, char* buffer, size_t size) {
+    if (task->flags & COMPACT_TIME_RAW) {
+        return list->strings.data + task->time;
+    }
+    formatCompactTime(task->time, task->flags, buffer, size);
+    return buffer;
+}
+
+// Function to list all tasks of a CompactTaskList
+void listCompactTasks(const CompactTaskList* list) {
+    if (list->firstTask == COMPACT_TASK_NONE) {
+        printf("No tasks available.\n");
+        return;
+    }
+
+    char date[16];
+    char time[16];
+    uint32_t current = list->firstTask;
+    while (current != COMPACT_TASK_NONE) {
+        const CompactTask* task = &list->tasks[current];
+        printTask(task->id,
+                  compactTaskName(list, task),
+                  compactTaskDate(list, task, date, sizeof(date)),
+                  compactTaskTime(list, task, time, sizeof(time)),
+                  compactTaskDescription(list, task),
+                  (Priority)task->priority);
+        current = task->nextTask;
+    }
+}
+
+// Function to delete a task by ID from a CompactTaskList
+// The node is reused by later additions and its strings are released.
+bool deleteCompactTask(CompactTaskList* list, int id) {
+    uint32_t index = findCompactTask(list, id);
+    if (index == COMPACT_TASK_NONE) {
+        return false; // Task not found
+    }
+
+    CompactTask* task = &list->tasks[index];
+    if (task->previousTask != COMPACT_TASK_NONE) {
+        list->tasks[task->previousTask].nextTask = task->nextTask;
+    } else {
+        // Deleting the first task
+        list->firstTask = task->nextTask;
+    }
+
+    if (task->nextTask != COMPACT_TASK_NONE) {
+        list->tasks[task->nextTask].previousTask = task->previousTask;
+    } else {
+        // Deleting the last task
+        list->lastTask = task->previousTask;
+    }
+
+    releaseHeapString(&list->strings, task->nameOffset);
+    releaseHeapString(&list->strings, task->descriptionOffset);
+    if (task->flags & COMPACT_DATE_RAW) {
+        releaseHeapString(&list->strings, task->date);
+    }
+    if (task->flags & COMPACT_TIME_RAW) {
+        releaseHeapString(&list->strings, task->time);
+    }
+
+    task->nextTask = list->freeTask;
+    task->previousTask = COMPACT_TASK_NONE;
+    list->freeTask = index;
+    list->count--;
+    trimStringHeap(list);
+    return true;
+}
+
+// Function to update a task by ID in a CompactTaskList
+bool updateCompactTask(CompactTaskList* list, int id) {
+    uint32_t index = findCompactTask(list, id);
+    if (index == COMPACT_TASK_NONE) {
+        return false; // Task not found
+    }
+
+    printf("Updating Task ID: %d\n", id);
+
+    TaskUpdate update;
+    promptTaskUpdate(&update);
+
+    CompactTask* task = &list->tasks[index];
+    bool stored = (!update.hasName || replaceHeapString(&list->strings, &task->nameOffset, update.name)) &&
+                  (!update.hasDate || setCompactDate(list, task, update.date)) &&
+                  (!update.hasTime || setCompactTime(list, task, update.time)) &&
+                  (!update.hasDescription || replaceHeapString(&list->strings, &task->descriptionOffset, update.description));
+    trimStringHeap(list);
+    if (!stored) {
+        fprintf(stderr, "Error: Unable to allocate memory for task strings.\n");
+        return false;
+    }
+    if (update.hasPriority) {
+        task->priority = (uint8_t)update.priority;
+    }
+
+    printf("Task updated successfully.\n");
+    return true;
+}
+
+// Function to free all allocated memory in the CompactTaskList
+void freeCompactTaskList(CompactTaskList* list) {
+    free(list->tasks);
+    free(list->strings.data);
+    free(list->strings.slots);
+    initializeCompactTaskList(list);
+}
+
+// Function to save a CompactTaskList to a CSV file
+bool saveCompactTasksToFile(const CompactTaskList* list, const char* filename) {
+    FILE* file = fopen(filename, "w");
+    if (file == NULL) {
+        fprintf(stderr, "Error: Unable to open file '%s' for writing.\n", filename);
+        return false;
+    }
+
+    char date[16];
+    char time[16];
+    uint32_t current = list->firstTask;
+    while (current != COMPACT_TASK_NONE) {
+        const CompactTask* task = &list->tasks[current];
+        writeTaskLine(file, task->id,
+                      compactTaskName(list, task),
+                      compactTaskDate(list, task, date, sizeof(date)),
+                      compactTaskTime(list, task, time, sizeof(time)),
+                      compactTaskDescription(list, task),
+                      (Priority)task->priority);
+        current = task->nextTask;
+    }
+
+    fclose(file);
+    return true;
+}
+
+// Function to load tasks from a CSV file into a CompactTaskList
+bool loadCompactTasksFromFile(CompactTaskList* list, const char* filename) {
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        // File may not exist initially; handle gracefully
+        return false;
+    }
+
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        TaskRecord record;
+        if (parseTaskLine(line, &record)) {
+            uint32_t index = addCompactTask(list, record.id, record.name, record.date, record.time, record.description, record.priority);
+            if (index == COMPACT_TASK_NONE) {
+                fprintf(stderr, "Warning: Skipping task ID %d with unsupported priority %d.\n", record.id, (int)record.priority);
+            }
+        }
+    }
+
+    fclose(file);
+    return true;
+}
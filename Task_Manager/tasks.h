@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 // Enum for task priority
@@ -16,21 +17,36 @@ typedef enum {
     CRITICAL
 } Priority;
 
+// Strings shorter than this are stored inside the Task node itself
+#define TASK_INLINE_STRING_SIZE 16
+
 // Forward declaration of Task
 typedef struct Task Task;
 
 // Definition of Task structure
+// name and description point either into the inline buffers below or to a
+// shared, reference-counted interned string; they must not be freed directly.
+// Use setTaskName/setTaskDescription and destroyTask.
 struct Task {
     int id;
-    char* name;
+    const char* name;
     char date[50];
     char time[15];
-    char* description;
+    const char* description;
     Priority priority;
     Task* nextTask;
     Task* previousTask;
+    char nameInline[TASK_INLINE_STRING_SIZE];
+    char descriptionInline[TASK_INLINE_STRING_SIZE];
 };
 
+// Statistics about the string interning table
+typedef struct {
+    size_t uniqueStrings;  // Number of distinct strings currently interned
+    size_t references;     // Total references held on interned strings
+    size_t bytes;          // Heap bytes used by interned strings and the table
+} InternStats;
+
 // Definition of TaskList structure (Doubly Linked List)
 typedef struct {
     Task* firstTask;  // Pointer to the first task in the list (head)
@@ -38,9 +54,67 @@ typedef struct {
     size_t count;     // Number of tasks currently stored
 } TaskList;
 
+// Sentinel index meaning "no task" in a CompactTaskList
+#define COMPACT_TASK_NONE UINT32_MAX
+
+// Flags describing how a CompactTask stores its date and time
+enum {
+    COMPACT_DATE_RAW   = 1 << 0,  // date is a string heap offset, not packed
+    COMPACT_DATE_SLASH = 1 << 1,  // packed date uses '/' instead of '-'
+    COMPACT_TIME_RAW   = 1 << 2,  // time is a string heap offset, not packed
+    COMPACT_TIME_12H   = 1 << 3   // packed time is printed as HH:MM AM/PM
+};
+
+// Compact Task node stored by value in a CompactTaskList
+// Links are indices into the list's task array and strings are offsets into
+// its string heap. Dates are packed as (year << 9 | month << 5 | day) and
+// times as minutes since midnight; values that would not print back exactly
+// are kept as raw strings in the heap instead.
+typedef struct {
+    int32_t id;
+    uint32_t nameOffset;
+    uint32_t descriptionOffset;
+    uint32_t date;
+    uint32_t time;
+    uint32_t nextTask;
+    uint32_t previousTask;
+    uint8_t priority;
+    uint8_t flags;
+} CompactTask;
+
+// String storage shared by all tasks of a CompactTaskList
+// Identical strings are stored once, each preceded by a 32-bit reference
+// count. slots is an open addressing index of string offsets, with 0 marking
+// an empty slot. Strings that are no longer referenced are counted in garbage
+// and dropped when the heap is compacted, once garbage exceeds half its size.
+typedef struct {
+    char* data;
+    uint32_t size;
+    uint32_t capacity;
+    uint32_t garbage;
+    uint32_t* slots;
+    uint32_t slotCount;
+    uint32_t slotsUsed;
+} StringHeap;
+
+// Definition of CompactTaskList structure (Doubly Linked List in one array)
+typedef struct {
+    CompactTask* tasks;     // Contiguous storage for all task nodes
+    uint32_t capacity;      // Number of nodes allocated in tasks
+    uint32_t used;          // Number of nodes handed out so far
+    uint32_t freeTask;      // First reusable node of deleted tasks
+    uint32_t firstTask;     // Index of the first task in the list (head)
+    uint32_t lastTask;      // Index of the last task in the list (tail)
+    size_t count;           // Number of tasks currently stored
+    StringHeap strings;     // Names, descriptions and raw dates/times
+} CompactTaskList;
+
 // Function Prototypes
 void initializeTaskList(TaskList* list);
 Task* createTask(int id, const char* name, const char* date, const char* time, const char* description, Priority priority);
+void destroyTask(Task* task);
+bool setTaskName(Task* task, const char* name);
+bool setTaskDescription(Task* task, const char* description);
 void addTask(TaskList* list, Task* newTask);
 void listTasks(const TaskList* list);
 bool deleteTask(TaskList* list, int id);
@@ -50,4 +124,22 @@ bool saveTasksToFile(const TaskList* list, const char* filename);
 bool loadTasksFromFile(TaskList* list, const char* filename);
 void clearInputBuffer(void);
 
+// Compact task list
+void initializeCompactTaskList(CompactTaskList* list);
+uint32_t addCompactTask(CompactTaskList* list, int id, const char* name, const char* date, const char* time, const char* description, Priority priority);
+uint32_t findCompactTask(const CompactTaskList* list, int id);
+const char* compactTaskName(const CompactTaskList* list, const CompactTask* task);
+const char* compactTaskDescription(const CompactTaskList* list, const CompactTask* task);
+const char* compactTaskDate(const CompactTaskList* list, const CompactTask* task, char* buffer, size_t size);
+const char* compactTaskTime(const CompactTaskList* list, const CompactTask* task, char* buffer, size_t size);
+void listCompactTasks(const CompactTaskList* list);
+bool deleteCompactTask(CompactTaskList* list, int id);
+bool updateCompactTask(CompactTaskList* list, int id);
+void freeCompactTaskList(CompactTaskList* list);
+bool saveCompactTasksToFile(const CompactTaskList* list, const char* filename);
+bool loadCompactTasksFromFile(CompactTaskList* list, const char* filename);
+
+// String interning
+InternStats getInternStats(void);
+
 #endif // TASKS_H
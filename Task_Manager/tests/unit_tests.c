@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <unistd.h>
 #include <CUnit/Basic.h>
 #include <CUnit/CUnit.h>
 #include "../tasks.h"
@@ -17,12 +18,6 @@ const char* description = "Description of Task 1";
 Priority priority = LOW;
 
 
-void freeTask(Task* task){
-    free(task->name);
-    free(task->description);
-    free(task);
-}
-
 void test_createTask(void){
 
     Task* t_task = createTask(id,name,date,time,description,priority);
@@ -35,7 +30,7 @@ void test_createTask(void){
     CU_ASSERT_EQUAL(priority, t_task->priority);
     CU_ASSERT_PTR_NULL(t_task->nextTask);
 
-    freeTask(t_task);
+    destroyTask(t_task);
 }
 // Test for addTask function
 void test_addTask(void) {
@@ -107,11 +102,10 @@ void test_updateTask(void) {
     // Update task details
     // Note: Since updateTask involves user input, we'll simulate it by directly modifying the task
     // Alternatively, refactor updateTask to accept parameters for easier testing
-    strcpy(task->name, "Updated Task");
+    CU_ASSERT_TRUE(setTaskName(task, "Updated Task"));
     strcpy(task->date, "2024-11-05");
     strcpy(task->time, "02:00 PM");
-    free(task->description);
-    task->description = strdup("Updated description.");
+    CU_ASSERT_TRUE(setTaskDescription(task, "Updated description."));
     task->priority = HIGH;
 
     CU_ASSERT_STRING_EQUAL(task->name, "Updated Task");
@@ -124,6 +118,291 @@ void test_updateTask(void) {
     freeTaskList(&list);
 }
 
+// Test for string interning and inline storage of task strings
+void test_internString(void) {
+    InternStats before = getInternStats();
+
+    Task* task1 = createTask(1, "Short", "2024-11-01", "09:00 AM", "Shared long description text.", LOW);
+    Task* task2 = createTask(2, "Short", "2024-11-02", "10:00 AM", "Shared long description text.", LOW);
+
+    // Short names live inside the node, long descriptions are shared
+    CU_ASSERT_PTR_EQUAL(task1->name, task1->nameInline);
+    CU_ASSERT_PTR_EQUAL(task2->name, task2->nameInline);
+    CU_ASSERT_PTR_EQUAL(task1->description, task2->description);
+    CU_ASSERT_STRING_EQUAL(task1->description, "Shared long description text.");
+
+    InternStats shared = getInternStats();
+    CU_ASSERT_EQUAL(shared.uniqueStrings, before.uniqueStrings + 1);
+    CU_ASSERT_EQUAL(shared.references, before.references + 2);
+
+    // Changing one task must not affect the other
+    CU_ASSERT_TRUE(setTaskDescription(task1, "A different long description."));
+    CU_ASSERT_STRING_EQUAL(task2->description, "Shared long description text.");
+    CU_ASSERT_EQUAL(getInternStats().uniqueStrings, before.uniqueStrings + 2);
+
+    destroyTask(task1);
+    destroyTask(task2);
+
+    InternStats after = getInternStats();
+    CU_ASSERT_EQUAL(after.uniqueStrings, before.uniqueStrings);
+    CU_ASSERT_EQUAL(after.references, before.references);
+    CU_ASSERT_EQUAL(after.bytes, before.bytes);
+}
+
+// Test for the CompactTaskList representation
+void test_compactTaskList(void) {
+    CompactTaskList list;
+    initializeCompactTaskList(&list);
+    char date[16];
+    char time[16];
+
+    uint32_t first = addCompactTask(&list, 1, "Backup", "2024-11-01", "09:00 AM", "Nightly backup.", MEDIUM);
+    uint32_t second = addCompactTask(&list, 2, "Backup", "2004/03/02", "17:30", "Nightly backup.", HIGH);
+    uint32_t third = addCompactTask(&list, 3, "Report", "next week", "soon", "Weekly report.", LOW);
+
+    CU_ASSERT_EQUAL(list.count, 3);
+    CU_ASSERT_EQUAL(list.firstTask, first);
+    CU_ASSERT_EQUAL(list.lastTask, third);
+    CU_ASSERT_EQUAL(list.tasks[first].nextTask, second);
+    CU_ASSERT_EQUAL(list.tasks[third].previousTask, second);
+    CU_ASSERT_TRUE(sizeof(CompactTask) * 2 <= sizeof(Task));
+
+    // Identical strings share one copy in the string heap
+    CU_ASSERT_EQUAL(list.tasks[first].nameOffset, list.tasks[second].nameOffset);
+    CU_ASSERT_EQUAL(list.tasks[first].descriptionOffset, list.tasks[second].descriptionOffset);
+    CU_ASSERT_STRING_EQUAL(compactTaskName(&list, &list.tasks[third]), "Report");
+
+    // Dates and times are packed when possible and always print back unchanged
+    CU_ASSERT_FALSE(list.tasks[first].flags & (COMPACT_DATE_RAW | COMPACT_TIME_RAW));
+    CU_ASSERT_TRUE(list.tasks[third].flags & COMPACT_DATE_RAW);
+    CU_ASSERT_STRING_EQUAL(compactTaskDate(&list, &list.tasks[first], date, sizeof(date)), "2024-11-01");
+    CU_ASSERT_STRING_EQUAL(compactTaskTime(&list, &list.tasks[first], time, sizeof(time)), "09:00 AM");
+    CU_ASSERT_STRING_EQUAL(compactTaskDate(&list, &list.tasks[second], date, sizeof(date)), "2004/03/02");
+    CU_ASSERT_STRING_EQUAL(compactTaskTime(&list, &list.tasks[second], time, sizeof(time)), "17:30");
+    CU_ASSERT_STRING_EQUAL(compactTaskDate(&list, &list.tasks[third], date, sizeof(date)), "next week");
+    CU_ASSERT_STRING_EQUAL(compactTaskTime(&list, &list.tasks[third], time, sizeof(time)), "soon");
+
+    // A longer name whose lookup probes the slot of a one-character string
+    // stored near the start of the heap must miss it and get its own copy
+    CompactTaskList probeList;
+    initializeCompactTaskList(&probeList);
+    uint32_t shortTask = addCompactTask(&probeList, 1, "B", "2024-11-01", "09:00 AM", "B", LOW);
+    size_t length;
+    size_t mask = probeList.strings.slotCount - 1;
+    size_t slot = hashString("B", &length) & mask;
+    char longName[300];
+    for (int suffix = 0; ; suffix++) {
+        snprintf(longName, sizeof(longName), "%0290d", suffix);
+        if ((hashString(longName, &length) & mask) == slot) {
+            break;
+        }
+    }
+    uint32_t longTask = addCompactTask(&probeList, 2, longName, "2024-11-01", "09:00 AM", "B", LOW);
+    CU_ASSERT_NOT_EQUAL(probeList.tasks[shortTask].nameOffset, probeList.tasks[longTask].nameOffset);
+    CU_ASSERT_STRING_EQUAL(compactTaskName(&probeList, &probeList.tasks[findCompactTask(&probeList, 1)]), "B");
+    CU_ASSERT_STRING_EQUAL(compactTaskName(&probeList, &probeList.tasks[findCompactTask(&probeList, 2)]), longName);
+    freeCompactTaskList(&probeList);
+
+    // Priorities that do not fit the compact layout are rejected
+    CU_ASSERT_EQUAL(addCompactTask(&list, 5, "Invalid", "2024-11-01", "09:00 AM", "Invalid.", (Priority)300), COMPACT_TASK_NONE);
+    CU_ASSERT_EQUAL(addCompactTask(&list, 5, "Invalid", "2024-11-01", "09:00 AM", "Invalid.", (Priority)0), COMPACT_TASK_NONE);
+    CU_ASSERT_EQUAL(list.count, 3);
+
+    // Delete the middle task and check the links
+    CU_ASSERT_TRUE(deleteCompactTask(&list, 2));
+    CU_ASSERT_FALSE(deleteCompactTask(&list, 2));
+    CU_ASSERT_EQUAL(list.count, 2);
+    CU_ASSERT_EQUAL(list.tasks[first].nextTask, third);
+    CU_ASSERT_EQUAL(list.tasks[third].previousTask, first);
+    CU_ASSERT_EQUAL(findCompactTask(&list, 2), COMPACT_TASK_NONE);
+
+    // The freed node is reused by the next addition
+    uint32_t fourth = addCompactTask(&list, 4, "Deploy", "2024-11-04", "12:00 PM", "Deploy release.", CRITICAL);
+    CU_ASSERT_EQUAL(fourth, second);
+    CU_ASSERT_EQUAL(list.lastTask, fourth);
+    CU_ASSERT_EQUAL(findCompactTask(&list, 4), fourth);
+    CU_ASSERT_STRING_EQUAL(compactTaskTime(&list, &list.tasks[fourth], time, sizeof(time)), "12:00 PM");
+
+    // Delete the first and last tasks
+    CU_ASSERT_TRUE(deleteCompactTask(&list, 1));
+    CU_ASSERT_TRUE(deleteCompactTask(&list, 4));
+    CU_ASSERT_EQUAL(list.firstTask, third);
+    CU_ASSERT_EQUAL(list.lastTask, third);
+
+    // Clean up
+    freeCompactTaskList(&list);
+    CU_ASSERT_PTR_NULL(list.tasks);
+    CU_ASSERT_EQUAL(list.count, 0);
+}
+
+// Function to read a whole file into a newly allocated string
+char* readFile(const char* filename) {
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+    char* contents = (char*)malloc((size_t)size + 1);
+    size_t read = fread(contents, 1, (size_t)size, file);
+    contents[read] = '\0';
+    fclose(file);
+    return contents;
+}
+
+// Test for saving and loading a TaskList with an unknown priority
+void test_saveLoadTasks(void) {
+    const char* input = "tasklist_input.csv";
+    const char* output = "tasklist_output.csv";
+    const char* contents =
+        "1,\"Known\",\"2024-11-01\",\"09:00 AM\",\"Known priority.\",2\n"
+        "2,\"Unknown\",\"2024-11-02\",\"10:00 AM\",\"Unknown priority.\",5\n";
+
+    FILE* file = fopen(input, "w");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(file);
+    fputs(contents, file);
+    fclose(file);
+
+    TaskList list;
+    initializeTaskList(&list);
+    CU_ASSERT_TRUE(loadTasksFromFile(&list, input));
+    CU_ASSERT_EQUAL(list.count, 2);
+    CU_ASSERT_EQUAL(list.lastTask->priority, 5);
+    CU_ASSERT_TRUE(saveTasksToFile(&list, output));
+    freeTaskList(&list);
+
+    // Rows with priorities outside LOW..CRITICAL are kept unchanged
+    char* saved = readFile(output);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(saved);
+    CU_ASSERT_STRING_EQUAL(saved, contents);
+
+    // Clean up
+    free(saved);
+    remove(input);
+    remove(output);
+}
+
+// Test for saving and loading a CompactTaskList
+void test_compactTaskFile(void) {
+    const char* input = "compact_input.csv";
+    const char* firstSave = "compact_first.csv";
+    const char* secondSave = "compact_second.csv";
+
+    // Packed and raw dates/times, 12h and 24h times, names that are prefixes
+    // of each other, and a line with an out-of-range priority
+    FILE* file = fopen(input, "w");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(file);
+    fprintf(file, "1,\"Backup\",\"2024-11-01\",\"09:00 AM\",\"Nightly backup.\",2\n");
+    fprintf(file, "2,\"Backup database and rotate logs\",\"2004/03/02\",\"17:30\",\"Nightly backup.\",3\n");
+    fprintf(file, "3,\"B\",\"next week\",\"soon\",\"Weekly\",1\n");
+    fprintf(file, "4,\"Backup database\",\"2024-1-5\",\"9:00 AM\",\"Weekly report.\",4\n");
+    fprintf(file, "5,\"Out of range\",\"2024-11-01\",\"12:00 PM\",\"Ignored.\",300\n");
+    fprintf(file, "6,\"Midnight\",\"2024-12-31\",\"12:00 AM\",\"New year.\",1\n");
+    fclose(file);
+
+    CompactTaskList list;
+    initializeCompactTaskList(&list);
+    CU_ASSERT_TRUE(loadCompactTasksFromFile(&list, input));
+    CU_ASSERT_EQUAL(list.count, 5);
+    CU_ASSERT_EQUAL(findCompactTask(&list, 5), COMPACT_TASK_NONE);
+    CU_ASSERT_TRUE(list.tasks[findCompactTask(&list, 4)].flags & COMPACT_DATE_RAW);
+    CU_ASSERT_TRUE(list.tasks[findCompactTask(&list, 4)].flags & COMPACT_TIME_RAW);
+    CU_ASSERT_FALSE(list.tasks[findCompactTask(&list, 6)].flags & (COMPACT_DATE_RAW | COMPACT_TIME_RAW));
+    listCompactTasks(&list);
+    CU_ASSERT_TRUE(saveCompactTasksToFile(&list, firstSave));
+    freeCompactTaskList(&list);
+
+    CU_ASSERT_TRUE(loadCompactTasksFromFile(&list, firstSave));
+    CU_ASSERT_TRUE(saveCompactTasksToFile(&list, secondSave));
+    freeCompactTaskList(&list);
+
+    // Every accepted line is written back unchanged
+    char* original = readFile(input);
+    char* first = readFile(firstSave);
+    char* second = readFile(secondSave);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(original);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(first);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(second);
+    CU_ASSERT_STRING_EQUAL(first, second);
+    CU_ASSERT_PTR_NULL(strstr(first, "Out of range"));
+    *strstr(original, "5,\"Out of range\"") = '\0';
+    CU_ASSERT_EQUAL(strncmp(first, original, strlen(original)), 0);
+    CU_ASSERT_PTR_NOT_NULL(strstr(first, "6,\"Midnight\",\"2024-12-31\",\"12:00 AM\",\"New year.\",1\n"));
+
+    // Clean up
+    free(original);
+    free(first);
+    free(second);
+    remove(input);
+    remove(firstSave);
+    remove(secondSave);
+}
+
+// Test for updateCompactTask function and string heap reuse
+void test_updateCompactTask(void) {
+    const char* answers = "compact_answers.txt";
+    const int edits = 200;
+
+    // Each edit renames the task and switches between raw and packed values
+    FILE* file = fopen(answers, "w");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(file);
+    for (int i = 0; i < edits; i++) {
+        fprintf(file, "Renamed task number %d\n%s\n%s\nDescription revision %d\n%d\n",
+                i, i % 2 ? "someday" : "2024-11-05", i % 2 ? "later" : "02:00 PM", i, i % 4 + 1);
+    }
+    fprintf(file, "\n\n\n\n\n");
+    fclose(file);
+
+    // Feed the answers through stdin, keeping the original to restore later
+    int savedStdin = dup(fileno(stdin));
+    CU_ASSERT_FATAL(savedStdin != -1);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(freopen(answers, "r", stdin));
+
+    CompactTaskList list;
+    initializeCompactTaskList(&list);
+    addCompactTask(&list, 1, "Original Task", "2024-11-01", "09:00 AM", "Original description.", MEDIUM);
+    uint32_t index = addCompactTask(&list, 2, "Kept Task", "whenever", "noon", "Kept description.", LOW);
+
+    for (int i = 0; i < edits; i++) {
+        CU_ASSERT_TRUE(updateCompactTask(&list, 1));
+    }
+    CU_ASSERT_FALSE(updateCompactTask(&list, 3));
+
+    // Blank answers keep the previous values
+    CU_ASSERT_TRUE(updateCompactTask(&list, 1));
+
+    char date[16];
+    char time[16];
+    const CompactTask* task = &list.tasks[findCompactTask(&list, 1)];
+    CU_ASSERT_STRING_EQUAL(compactTaskName(&list, task), "Renamed task number 199");
+    CU_ASSERT_STRING_EQUAL(compactTaskDescription(&list, task), "Description revision 199");
+    CU_ASSERT_STRING_EQUAL(compactTaskDate(&list, task, date, sizeof(date)), "someday");
+    CU_ASSERT_STRING_EQUAL(compactTaskTime(&list, task, time, sizeof(time)), "later");
+    CU_ASSERT_EQUAL(task->priority, CRITICAL);
+
+    // Strings of the untouched task survive compaction
+    task = &list.tasks[index];
+    CU_ASSERT_STRING_EQUAL(compactTaskName(&list, task), "Kept Task");
+    CU_ASSERT_STRING_EQUAL(compactTaskDescription(&list, task), "Kept description.");
+    CU_ASSERT_STRING_EQUAL(compactTaskDate(&list, task, date, sizeof(date)), "whenever");
+    CU_ASSERT_STRING_EQUAL(compactTaskTime(&list, task, time, sizeof(time)), "noon");
+
+    // Replaced strings are reclaimed instead of accumulating
+    CU_ASSERT_TRUE(list.strings.size < 4 * STRING_HEAP_INITIAL_SIZE);
+
+    // Deleting releases the task's strings
+    CU_ASSERT_TRUE(deleteCompactTask(&list, 1));
+    CU_ASSERT_TRUE(list.strings.garbage > 0);
+
+    // Clean up
+    freeCompactTaskList(&list);
+    dup2(savedStdin, fileno(stdin));
+    close(savedStdin);
+    clearerr(stdin);
+    remove(answers);
+}
+
 // Suite Initialization
 int init_suite(void) {
     return 0;
@@ -150,7 +429,12 @@ int main() {
     if ((NULL == CU_add_test(suite, "test of createTask()", test_createTask)) ||
         (NULL == CU_add_test(suite, "test of addTask()", test_addTask)) ||
         (NULL == CU_add_test(suite, "test of deleteTask()", test_deleteTask)) ||
-        (NULL == CU_add_test(suite, "test of updateTask()", test_updateTask))) {
+        (NULL == CU_add_test(suite, "test of updateTask()", test_updateTask)) ||
+        (NULL == CU_add_test(suite, "test of internString()", test_internString)) ||
+        (NULL == CU_add_test(suite, "test of CompactTaskList", test_compactTaskList)) ||
+        (NULL == CU_add_test(suite, "test of save/loadTasksFromFile()", test_saveLoadTasks)) ||
+        (NULL == CU_add_test(suite, "test of save/loadCompactTasksFromFile()", test_compactTaskFile)) ||
+        (NULL == CU_add_test(suite, "test of updateCompactTask()", test_updateCompactTask))) {
         CU_cleanup_registry();
         return CU_get_error();
     }